@@ -7,6 +7,7 @@
 #define COLOR_BLUE  "\x1B[94m"
 #define COLOR_RESET "\x1B[m"
 #define COLOR_BLINK "\x1B[5m"
+#define COLOR_YELLOW "\x1B[93m"
 
 /**
  * Board constructor: randomly places ships without overlapping.
@@ -20,7 +21,7 @@ Board::Board(int width, int height, int numShips)
     std::uniform_int_distribution<> rowDist(0, h-1);
     std::uniform_int_distribution<> colDist(0, w-1);
     std::uniform_int_distribution<> dirDist(0,1); // 0=horizontal, 1=vertical
-    std::uniform_int_distribution<> sizeDist(2,4); // ship size 2–4
+    std::uniform_int_distribution<> sizeDist(SHIP_SIZE_MIN, SHIP_SIZE_MAX); // ship size 2–4
     int placed = 0;
     while (placed < numShips) {
         int shipSize = sizeDist(gen);
@@ -80,6 +81,7 @@ bool Board::shoot(int row, int col) {
 
     lastRow = row;
     lastCol = col;
+    rev++;
 
     if (field[i]=='S') {
         field[i] = 'X';
@@ -107,8 +109,31 @@ int Board::shipsRemaining() const {
     return count;
 }
 
+/** Build the player's view of the board (ships hidden, sunk ships marked) */
+std::vector<char> Board::observe() const {
+    std::vector<char> view(field.size(), '.');
+    for (size_t i = 0; i < field.size(); ++i) {
+        if (field[i] == 'X' || field[i] == 'o') view[i] = field[i];
+    }
+
+    /** Sunk ships are known to the player through the ships remaining counter */
+    for (const Ship& s : ships) {
+        if (!s.isSunk(field, w)) continue;
+        for (auto [r, c] : s.cells) view[index(r, c)] = '#';
+    }
+    return view;
+}
+
 /** Draw board to terminal */
-void Board::draw() const {
+void Board::draw(const std::vector<double>& heat) const {
+    /** Find the hottest cell for highlighting */
+    int best = -1;
+    if (heat.size() == field.size()) {
+        for (int i = 0; i < (int)heat.size(); ++i) {
+            if (heat[i] > 0 && (best < 0 || heat[i] > heat[best])) best = i;
+        }
+    }
+
     /** Column numbers */
     std::cout << "    "; // space for row numbers
     for (int c = 0; c < w; ++c) {
@@ -130,6 +155,12 @@ void Board::draw() const {
 
             if (cell == 'X') std::cout << COLOR_RED << cell << COLOR_RESET << ' ';
             else if (cell == 'o') std::cout << COLOR_BLUE << cell << COLOR_RESET << ' ';
+            else if (best >= 0 && heat[index(r, c)] > 0) {
+                /** Heat overlay: 0 = cold .. 9 = hottest cell */
+                int level = (int)(heat[index(r, c)] / heat[best] * 9.0 + 0.5);
+                if (index(r, c) == best) std::cout << COLOR_BLINK;
+                std::cout << COLOR_YELLOW << level << COLOR_RESET << ' ';
+            }
             else std::cout << ". ";
         }
         std::cout << '\n';
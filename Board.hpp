@@ -1,6 +1,10 @@
 #pragma once
 #include <vector>
 
+/** Ship length range used for random placement (and assumed by the hint engine) */
+#define SHIP_SIZE_MIN 2
+#define SHIP_SIZE_MAX 4
+
 /**
  * Ship represents a single ship on the board.
  * Stores the coordinates of all cells the ship occupies.
@@ -31,8 +35,11 @@ public:
      */
     Board(int width, int height, int numShips = 3);
     
-    /** Draw the current board state to the console */
-    void draw() const;
+    /**
+     * Draw the current board state to the console.
+     * If heat is not empty, unknown cells show a 0-9 shot-probability overlay.
+     */
+    void draw(const std::vector<double>& heat = {}) const;
 
     /**
      * Shoot at a given cell.
@@ -48,11 +55,24 @@ public:
     /** Draw the board with ship positions visible (debug mode) */
     void debugDrawShips() const;
 
+    /**
+     * What the player can see: '.' = unknown, 'o' = miss,
+     * 'X' = hit on a floating ship, '#' = cell of a sunk ship.
+     */
+    std::vector<char> observe() const;
+
+    /** Counter increased every time a shot changes the board */
+    unsigned long revision() const { return rev; }
+
+    int width() const { return w; }
+    int height() const { return h; }
+
 private:
     int w, h; // // board dimensions
     std::vector<char> field; // '.' = empty, 'S' = ship, 'X' = hit, 'o' = miss
     std::vector<Ship> ships; // track ships individually
     int lastRow{-1}, lastCol{-1}; // last shot coordinates
+    unsigned long rev{0}; // number of state changing shots
 
     /** Convert (row, col) to linear index for the field vector */
     int index(int row, int col) const;
@@ -11,6 +11,7 @@
  */
 Game::Game(const GameSettings& settings)
     : board(settings.width, settings.height, settings.ships),
+      hints(settings.width, settings.height),
       maxAttempts(settings.maxAttempts),
       updated(true),
       running(true),
@@ -26,9 +27,12 @@ void Game::printRainbowASCII() {
  * Uses three threads:
  *  - inputThread: handles user input
  *  - renderThread: redraws the board when updated
- *  - computeThread: optional timing/animations
+ *  - computeThread: hint engine, solves the board while the player thinks
  */
 void Game::run() {
+    /** Start solving the empty board right away */
+    hints.submit(board.observe());
+
     /** Input thread */
     inputThread = std::thread([this]() {
         while (running) {
@@ -45,6 +49,21 @@ void Game::run() {
                 break;
             }
 
+            /** Hint command: show the precomputed heatmap */
+            if (line == "hint") {
+                std::lock_guard<std::mutex> lock(mtx);
+                int row, col;
+                if (hints.latest(hintHeat, row, col)) {
+                    lastMessage = "Hint: try " + std::to_string(row) + " " + std::to_string(col) +
+                                  " (9 = most likely ship cell)";
+                } else {
+                    lastMessage = "Hint is not ready yet, try again in a moment.";
+                }
+                updated = true;
+                cv.notify_all();
+                continue;
+            }
+
             /** Parse row and column */
             std::istringstream iss(line);
             int row, col;
@@ -56,8 +75,15 @@ void Game::run() {
                 continue; // skip this iteration
             }
 
-            /** Shoot at cell */
-            bool hit = board.shoot(row, col);
+            /** Shoot at cell, restart the hint engine if the board changed */
+            bool hit;
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                unsigned long revision = board.revision();
+                hit = board.shoot(row, col);
+                if (board.revision() != revision) hints.submit(board.observe());
+                hintHeat.clear(); // overlay is outdated now
+            }
             attempts++;
             if (hit) hits++;
             else misses++;
@@ -101,8 +127,8 @@ void Game::run() {
             system(CLEAR_SCREEN);
             std::cout << "A single player Sea Battle game in C++\n";
             printRainbowASCII();
-            std::cout << "Enter row col or q to quit\n\n";
-            board.draw();
+            std::cout << "Enter row col, hint or q to quit\n\n";
+            board.draw(hintHeat);
 
             if (!lastMessage.empty()) {
                 std::cout << lastMessage << "\n";
@@ -116,16 +142,14 @@ void Game::run() {
     });
 
 
-    /** Compute */
+    /** Compute: hint engine runs until the input thread is done */
     computeThread = std::thread([this]() {
-        while (running) {
-            std::this_thread::sleep_for(std::chrono::seconds(1));
-            // future: maybe timers, animations, scoring
-        }
+        hints.run();
     });
 
     /** Wait for threads */
     inputThread.join();
+    hints.stop();
     renderThread.join();
     computeThread.join();
     printStats();
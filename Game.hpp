@@ -1,5 +1,6 @@
 #pragma once
 #include "Board.hpp"
+#include "HintEngine.hpp"
 #include <thread>
 #include <mutex>
 #include <condition_variable>
@@ -33,6 +34,7 @@ public:
 
 private:
     Board board;
+    HintEngine hints; // background shot-probability solver
     int attempts;
     int maxAttempts;
     int hits = 0;
@@ -41,10 +43,11 @@ private:
     /** Threads and synchronization */
     std::thread inputThread; // input handling
     std::thread renderThread; // board rendering
-    std::thread computeThread; // optional timing
+    std::thread computeThread; // hint engine worker
     std::mutex mtx; // mutex for shared state
     std::condition_variable cv; // signal for rendering updates
     bool updated; // flag indicating board needs redraw
     std::atomic<bool> running; // game running flag
     std::string lastMessage; // message to display in terminal
+    std::vector<double> hintHeat; // heat overlay shown after "hint", empty = hidden
 };
@@ -0,0 +1,122 @@
+#include "HintEngine.hpp"
+#include "Board.hpp"
+
+/** Weight of a placement per unsunk hit it covers (finish damaged ships first) */
+#define HINT_HIT_WEIGHT 100.0
+
+HintEngine::HintEngine(int width, int height)
+    : w(width), h(height) {}
+
+/** Store the observation and cancel any computation for an older one */
+void HintEngine::submit(const std::vector<char>& observation) {
+    std::lock_guard<std::mutex> lock(mtx);
+    pending = observation;
+    generation++;
+    cv.notify_all();
+}
+
+/** Ask the worker to exit; an unfinished computation is abandoned */
+void HintEngine::stop() {
+    std::lock_guard<std::mutex> lock(mtx);
+    stopping = true;
+    generation++;
+    cv.notify_all();
+}
+
+/** Worker loop: wait for a new observation, compute, publish */
+void HintEngine::run() {
+    unsigned long done = 0;
+    while (true) {
+        std::vector<char> obs;
+        unsigned long gen;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [&]() { return stopping || generation != done; });
+            if (stopping) break;
+            obs = pending;
+            gen = generation;
+        }
+
+        std::vector<double> out;
+        done = gen;
+        if (!compute(obs, gen, out)) continue; // outdated, start over
+
+        std::lock_guard<std::mutex> lock(mtx);
+        if (gen != generation) continue; // a shot landed while publishing
+        heat = std::move(out);
+        ready = gen;
+    }
+}
+
+/** Return the finished heatmap if it matches the latest observation */
+bool HintEngine::latest(std::vector<double>& out, int& bestRow, int& bestCol) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (ready != generation || heat.empty()) return false;
+
+    int best = -1;
+    for (int i = 0; i < (int)heat.size(); ++i) {
+        if (heat[i] > 0 && (best < 0 || heat[i] > heat[best])) best = i;
+    }
+    if (best < 0) return false; // nothing left to shoot at
+
+    out = heat;
+    bestRow = best / w;
+    bestCol = best % w;
+    return true;
+}
+
+/**
+ * A ship fits if all its cells are unknown or unsunk hits and nothing
+ * around it is hit or sunk (ships never touch, not even diagonally).
+ */
+bool HintEngine::fits(const std::vector<char>& obs, int row, int col, int len, bool horizontal, int& hitsCovered) const {
+    int endRow = horizontal ? row : row + len - 1;
+    int endCol = horizontal ? col + len - 1 : col;
+    if (endRow >= h || endCol >= w) return false;
+
+    hitsCovered = 0;
+    for (int r = row - 1; r <= endRow + 1; ++r) {
+        for (int c = col - 1; c <= endCol + 1; ++c) {
+            if (r < 0 || r >= h || c < 0 || c >= w) continue;
+            char cell = obs[r * w + c];
+            bool inside = r >= row && r <= endRow && c >= col && c <= endCol;
+
+            if (inside) {
+                if (cell == 'o' || cell == '#') return false;
+                if (cell == 'X') hitsCovered++;
+            }
+            else if (cell == 'X' || cell == '#') return false; // would touch another ship
+        }
+    }
+    return true;
+}
+
+/**
+ * Probability density: sum the weights of all ship placements covering
+ * each unknown cell. Checks for cancellation after every row.
+ */
+bool HintEngine::compute(const std::vector<char>& obs, unsigned long gen, std::vector<double>& out) const {
+    out.assign(w * h, 0.0);
+
+    for (int r = 0; r < h; ++r) {
+        if (generation != gen) return false;
+
+        for (int c = 0; c < w; ++c) {
+            for (int len = SHIP_SIZE_MIN; len <= SHIP_SIZE_MAX; ++len) {
+                for (int dir = 0; dir < 2; ++dir) {
+                    bool horizontal = dir == 0;
+                    int hitsCovered;
+                    if (!fits(obs, r, c, len, horizontal, hitsCovered)) continue;
+
+                    double weight = hitsCovered > 0 ? HINT_HIT_WEIGHT * hitsCovered : 1.0;
+                    for (int i = 0; i < len; ++i) {
+                        int ri = horizontal ? r : r + i;
+                        int ci = horizontal ? c + i : c;
+                        if (obs[ri * w + ci] == '.') out[ri * w + ci] += weight;
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+/**
+ * HintEngine: computes a shot-probability heatmap in the background.
+ *
+ * Every submitted observation restarts the computation; a computation for
+ * an outdated observation is cancelled as soon as a newer one arrives.
+ * The finished heatmap is kept until the next submit, so asking for a
+ * hint never has to wait for the solver.
+ */
+class HintEngine {
+public:
+    HintEngine(int width, int height);
+
+    /** Publish a new board observation (see Board::observe) */
+    void submit(const std::vector<char>& observation);
+
+    /** Worker loop, meant to run on its own thread until stop() */
+    void run();
+
+    /** Cancel the current computation and let run() return */
+    void stop();
+
+    /**
+     * Copy the heatmap of the latest observation into heat.
+     * Returns false if it is still being computed.
+     */
+    bool latest(std::vector<double>& heat, int& bestRow, int& bestCol) const;
+
+private:
+    int w, h; // board dimensions
+
+    mutable std::mutex mtx; // guards everything below except generation
+    std::condition_variable cv; // wakes the worker on submit/stop
+    std::vector<char> pending; // latest observation to evaluate
+    std::vector<double> heat; // finished heatmap (raw placement weights)
+    unsigned long ready{0}; // generation the heatmap belongs to
+    bool stopping{false}; // worker should exit
+    std::atomic<unsigned long> generation{0}; // bumped on every submit
+
+    /**
+     * Count ship placements consistent with the observation.
+     * Returns false if cancelled because the generation changed.
+     */
+    bool compute(const std::vector<char>& obs, unsigned long gen, std::vector<double>& out) const;
+
+    /** Check if a ship of given length fits at (row, col) */
+    bool fits(const std::vector<char>& obs, int row, int col, int len, bool horizontal, int& hitsCovered) const;
+};